@@ -0,0 +1,157 @@
+// Memory benchmark for the editor: feeds TextEditor::run() one "insert"
+// command per corpus line followed by a few undos, the same path a user
+// takes, then reports peak RSS.
+//
+// Build from the repository root:
+//   g++ -O2 -std=c++11 bench/memory_bench.cpp -o memory_bench          (Linux)
+//   g++ -O2 -std=c++11 bench/memory_bench.cpp -o memory_bench -lpsapi  (Windows)
+// Run:
+//   memory_bench [lines] [corpus.txt]
+// Lines default to 1000000. Without a corpus file, deterministic synthetic
+// lines are generated; a short corpus file is read again from the start.
+
+#define main typingJattMain
+#include "../project.cpp"
+#undef main
+
+#include <chrono>
+#include <cstdlib>
+#ifdef _WIN32
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+
+// Peak resident set size of this process in bytes
+size_t peakRss() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+    return counters.PeakWorkingSetSize;
+#else
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;  // Reported in KiB on Linux
+#endif
+}
+
+
+// Corpus loader: reads lines from a file, or makes up lines from a fixed
+// word list (with a few common misspellings) when no file is given
+class Corpus {
+public:
+    explicit Corpus(const char* path) : counter(0) {
+        if (path) {
+            file.open(path);
+            if (!file) {
+                cerr << "Cannot open corpus file \"" << path << "\".\n";
+                exit(1);
+            }
+        }
+    }
+
+
+    string next() {
+        string line;
+        if (file.is_open()) {
+            if (!getline(file, line)) {
+                file.clear();
+                file.seekg(0);
+                getline(file, line);
+            }
+            return line;
+        }
+        static const char* const words[] = {
+            "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
+            "computer", "keyboard", "network", "algorithm", "teacher", "river",
+            "teh", "quik", "hello", "world", "example42", "mountain"
+        };
+        const size_t wordCount = sizeof(words) / sizeof(words[0]);
+        size_t seed = counter++;
+        for (int i = 0; i < 10; ++i) {
+            seed = seed * 1103515245 + 12345;
+            line += words[(seed >> 8) % wordCount];
+            line += ' ';
+        }
+        line += to_string(counter);
+        return line;
+    }
+
+
+private:
+    ifstream file;
+    size_t counter;
+};
+
+
+// Feeds the command script to cin one command at a time, so the benchmark
+// never holds the whole corpus in memory
+class ScriptBuffer : public streambuf {
+public:
+    ScriptBuffer(Corpus& corpus, size_t lines, size_t undos)
+        : corpus(corpus), lines(lines), undos(undos), inserted(0), undone(0), finished(false) {}
+
+
+protected:
+    int_type underflow() override {
+        if (gptr() < egptr()) return traits_type::to_int_type(*gptr());
+        if (!refill()) return traits_type::eof();
+        setg(&chunk[0], &chunk[0], &chunk[0] + chunk.size());
+        return traits_type::to_int_type(chunk[0]);
+    }
+
+
+private:
+    bool refill() {
+        if (inserted < lines) {
+            chunk = "insert\n" + corpus.next() + "\n";
+            ++inserted;
+        } else if (undone < undos) {
+            chunk = "undo\n";
+            ++undone;
+        } else if (!finished) {
+            chunk = "exit\n";
+            finished = true;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+
+    Corpus& corpus;
+    size_t lines;
+    size_t undos;
+    size_t inserted;
+    size_t undone;
+    bool finished;
+    string chunk;
+};
+
+
+int main(int argc, char** argv) {
+    size_t lines = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1000000;
+    Corpus corpus(argc > 2 ? argv[2] : nullptr);
+    ScriptBuffer script(corpus, lines, 10);
+
+    size_t startRss = peakRss();
+    auto start = chrono::steady_clock::now();
+
+    streambuf* savedIn = cin.rdbuf(&script);
+    streambuf* savedOut = cout.rdbuf(nullptr);  // Discard prompts and spell-check output
+    {
+        TextEditor editor;
+        editor.run();
+        cout.rdbuf(savedOut);
+        cout.clear();
+        editor.displayMemoryStats();
+    }
+    cin.rdbuf(savedIn);
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "\nLines inserted: " << lines << "\n";
+    cout << "Peak RSS:       " << peakRss() << " bytes (" << startRss << " before the editor)\n";
+    cout << "Time:           " << seconds << " s\n";
+    return 0;
+}
@@ -11,21 +11,266 @@
 #include <map>
 #include <vector>
 #include <limits>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+#ifdef _WIN32
 #include <windows.h> // For color functionality on Windows
+#endif
 using namespace std;
 
 
 // Function to set the console text color
 void setColor(int color) {
+#ifdef _WIN32
     SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), color);
+#else
+    (void)color;  // Console colors are only supported on Windows
+#endif
 }
 
 
-// Linked list node for text lines
+// Bump arena for text: bytes are carved out of large blocks and are only
+// released together when the arena itself is destroyed. Nothing is freed
+// individually, so bytesUsed() also counts text that has been superseded
+class TextArena {
+public:
+    explicit TextArena(size_t blockSize = 64 * 1024)
+        : blockSize(blockSize), cursor(nullptr), remaining(0), used(0), reserved(0) {}
+
+
+    ~TextArena() {
+        for (char* block : blocks) {
+            delete[] block;
+        }
+    }
+
+
+    TextArena(const TextArena&) = delete;
+    TextArena& operator=(const TextArena&) = delete;
+
+
+    // Copy the text into the arena and return a pointer to the stored bytes
+    const char* store(const string& text) {
+        return store(text.data(), text.size());
+    }
+
+
+    const char* store(const char* data, size_t size) {
+        if (size == 0) return "";
+        char* dest;
+        if (size > blockSize / 4) {
+            // Oversized lines get their own block so the current one is not wasted
+            dest = new char[size];
+            blocks.push_back(dest);
+            reserved += size;
+        } else {
+            if (size > remaining) {
+                cursor = new char[blockSize];
+                blocks.push_back(cursor);
+                remaining = blockSize;
+                reserved += blockSize;
+            }
+            dest = cursor;
+            cursor += size;
+            remaining -= size;
+        }
+        memcpy(dest, data, size);
+        used += size;
+        return dest;
+    }
+
+
+    size_t bytesUsed() const { return used; }
+    size_t bytesReserved() const { return reserved; }
+
+
+private:
+    size_t blockSize;
+    char* cursor;
+    size_t remaining;
+    size_t used;
+    size_t reserved;
+    vector<char*> blocks;
+};
+
+
+// Slab pool for fixed-size objects: slots are handed out from slabs and
+// recycled through a free list instead of going back to the heap
+template <typename T>
+class NodePool {
+public:
+    explicit NodePool(size_t slabSize = 1024)
+        : slabSize(slabSize), nextSlot(slabSize), freeList(nullptr), live(0) {}
+
+
+    ~NodePool() {
+        for (Slot* slab : slabs) {
+            delete[] slab;
+        }
+    }
+
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+
+    template <typename... Args>
+    T* create(Args&&... args) {
+        Slot* slot;
+        if (freeList) {
+            slot = freeList;
+            freeList = freeList->next;
+        } else {
+            if (nextSlot == slabSize) {
+                slabs.push_back(new Slot[slabSize]);
+                nextSlot = 0;
+            }
+            slot = &slabs.back()[nextSlot++];
+        }
+        ++live;
+        return new (slot->storage) T(std::forward<Args>(args)...);
+    }
+
+
+    void destroy(T* object) {
+        if (!object) return;
+        object->~T();
+        Slot* slot = reinterpret_cast<Slot*>(object);
+        slot->next = freeList;
+        freeList = slot;
+        --live;
+    }
+
+
+    size_t bytesUsed() const { return live * sizeof(Slot); }
+    size_t bytesReserved() const { return slabs.size() * slabSize * sizeof(Slot); }
+
+
+private:
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+
+    size_t slabSize;
+    size_t nextSlot;
+    Slot* freeList;
+    size_t live;
+    vector<Slot*> slabs;
+};
+
+
+// Intern table: every distinct word is stored once and referred to by ID
+typedef int WordId;
+const WordId NoWord = -1;
+
+
+class WordInterner {
+public:
+    WordInterner() : words(4 * 1024), slots(16, NoWord) {}
+
+
+    // Return the ID of the word, adding it to the table if it is new
+    WordId intern(const string& word) {
+        size_t slot = findSlot(word);
+        if (slots[slot] != NoWord) return slots[slot];
+        WordId id = static_cast<WordId>(entries.size());
+        // Stored NUL-terminated so text() can be printed directly
+        Entry entry = { words.store(word.c_str(), word.size() + 1), word.size() };
+        entries.push_back(entry);
+        slots[slot] = id;
+        if (entries.size() * 2 > slots.size()) {
+            rehash(slots.size() * 2);
+        }
+        return id;
+    }
+
+
+    // Look up a word without adding it; returns NoWord if it was never interned
+    WordId find(const string& word) const {
+        return slots[findSlot(word)];
+    }
+
+
+    const char* text(WordId id) const { return entries[id].text; }
+    size_t length(WordId id) const { return entries[id].length; }
+    size_t size() const { return entries.size(); }
+
+
+    // Word bytes plus the ID index and hash slots, as actually allocated
+    size_t bytesUsed() const {
+        return words.bytesReserved() + entries.capacity() * sizeof(Entry) +
+               slots.capacity() * sizeof(WordId);
+    }
+
+
+private:
+    struct Entry {
+        const char* text;  // Points into the words arena
+        size_t length;
+    };
+
+
+    TextArena words;
+    vector<Entry> entries;  // Indexed by WordId
+    vector<WordId> slots;   // Open-addressing hash table of IDs, size is a power of two
+
+
+    // 64-bit FNV-1a, computed in uint64_t so 32-bit builds hash the same way
+    static size_t hashBytes(const char* data, size_t length) {
+        uint64_t hash = 14695981039346656037ULL;
+        for (size_t i = 0; i < length; ++i) {
+            hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ULL;
+        }
+        return static_cast<size_t>(hash ^ (hash >> 32));
+    }
+
+
+    // Slot holding the word, or the empty slot where it would be inserted
+    size_t findSlot(const string& word) const {
+        size_t mask = slots.size() - 1;
+        size_t slot = hashBytes(word.data(), word.size()) & mask;
+        while (slots[slot] != NoWord) {
+            const Entry& entry = entries[slots[slot]];
+            if (entry.length == word.size() && memcmp(entry.text, word.data(), word.size()) == 0) {
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+
+    void rehash(size_t newSize) {
+        vector<WordId> newSlots(newSize, NoWord);
+        size_t mask = newSize - 1;
+        for (WordId id = 0; id < static_cast<WordId>(entries.size()); ++id) {
+            size_t slot = hashBytes(entries[id].text, entries[id].length) & mask;
+            while (newSlots[slot] != NoWord) {
+                slot = (slot + 1) & mask;
+            }
+            newSlots[slot] = id;
+        }
+        slots.swap(newSlots);
+    }
+};
+
+
+// Global intern table shared by the dictionary, spell checker and word graph
+WordInterner wordTable;
+
+
+// Linked list node for text lines; the text lives in the editor's line arena
+// and is never modified in place, so undo can point a line back at old text
 struct LineNode {
-    string text;
+    const char* text;
+    size_t length;
     LineNode* next;
-    LineNode(const string& txt) : text(txt), next(nullptr) {}
+    LineNode(const char* txt, size_t len) : text(txt), length(len), next(nullptr) {}
+    string str() const { return string(text, length); }
 };
 
 
@@ -33,17 +278,19 @@ struct LineNode {
 class WordGraph {
 public:
     void addEdge(const string& word1, const string& word2) {
-        adjacencyList[word1].push_back(word2);
-        adjacencyList[word2].push_back(word1);
+        WordId id1 = wordTable.intern(word1);
+        WordId id2 = wordTable.intern(word2);
+        adjacencyList[id1].push_back(id2);
+        adjacencyList[id2].push_back(id1);
     }
 
 
     void displayConnections(const string& word) const {
-        auto it = adjacencyList.find(word);
+        auto it = adjacencyList.find(wordTable.find(word));
         if (it != adjacencyList.end()) {
             cout << "Words connected to \"" << word << "\": ";
-            for (const auto& neighbor : it->second) {
-                cout << neighbor << " ";
+            for (WordId neighbor : it->second) {
+                cout << wordTable.text(neighbor) << " ";
             }
             cout << "\n";
         } else {
@@ -53,7 +300,7 @@ public:
 
 
 private:
-    unordered_map<string, vector<string>> adjacencyList;
+    unordered_map<WordId, vector<WordId>> adjacencyList;
 };
 
 
@@ -64,6 +311,8 @@ public:
         loadDefaultDictionary();
         loadCommonMisspellings();
         buffer = nullptr;
+        tail = nullptr;
+        pendingStart = 0;
     }
 
 
@@ -91,19 +340,22 @@ public:
         cout << "\nCurrent Text:\n";
         LineNode* current = buffer;
         while (current) {
-            cout << current->text << "\n";
+            cout.write(current->text, current->length) << "\n";
             current = current->next;
         }
     }
 
 
+    // Restore the most recently saved state: revert the edits made after it
+    // was saved, and keep its own edits around for the next undo
     void undo() {
-        if (undoStack.empty()) {
+        if (undoMarks.empty()) {
             cout << "No actions to undo.\n";
             return;
         }
-        buffer = undoStack.top();
-        undoStack.pop();
+        revertTo(pendingStart);
+        pendingStart = undoMarks.back();
+        undoMarks.pop_back();
         cout << "Undo successful.\n";
     }
 
@@ -136,9 +388,10 @@ public:
         int count = 0;
         LineNode* current = buffer;
         while (current) {
-            if (containsWord(current->text, targetWord)) {
+            if (containsWord(current->text, current->length, targetWord)) {
                 count++;
-                cout << "Found in line: " << current->text << "\n";
+                cout << "Found in line: ";
+                cout.write(current->text, current->length) << "\n";
             }
             current = current->next;
         }
@@ -166,8 +419,14 @@ public:
         bool replaced = false;
         LineNode* current = buffer;
         while (current) {
-            if (containsWord(current->text, targetWord)) {
-                replaceInLine(current->text, targetWord, newWord);
+            if (containsWord(current->text, current->length, targetWord)) {
+                // Undo may still point at the old text, so store the edited line anew
+                string line = current->str();
+                replaceInLine(line, targetWord, newWord);
+                UndoOp op = { current, current->text, current->length, false };
+                undoLog.push_back(op);
+                current->text = lineArena.store(line);
+                current->length = line.size();
                 replaced = true;
             }
             current = current->next;
@@ -187,7 +446,7 @@ public:
         cout << "Enter the word you want to ignore: ";
         string word;
         cin >> word;
-        ignoredWords.insert(word);  // Add the word to the ignored set
+        markWord(ignoredWords, wordTable.intern(word));  // Add the word to the ignored set
         cout << "The word \"" << word << "\" will be ignored in future spell checks.\n";
     }
 
@@ -196,11 +455,33 @@ public:
         cout << "Enter the word to add to your personal dictionary: ";
         string word;
         cin >> word;
-        dictionary.insert(word);  // Add the word to the dictionary
+        markWord(dictionary, wordTable.intern(word));  // Add the word to the dictionary
         cout << "The word \"" << word << "\" has been added to your personal dictionary.\n";
     }
 
 
+    void displayMemoryStats() const {
+        cout << "\nMemory usage:\n";
+        // Only the current buffer counts as live; the rest of the arena is text
+        // that was replaced or undone, some of which undo may still restore
+        size_t liveBytes = 0;
+        for (LineNode* current = buffer; current; current = current->next) {
+            liveBytes += current->length;
+        }
+        cout << "  Line arena:   " << liveBytes << " bytes live, "
+             << lineArena.bytesUsed() - liveBytes << " bytes superseded or held by undo, "
+             << lineArena.bytesReserved() << " bytes reserved\n";
+        cout << "  Node pool:    " << nodePool.bytesUsed() << " bytes used, "
+             << nodePool.bytesReserved() << " bytes reserved\n";
+        cout << "  Undo log:     " << undoLog.capacity() * sizeof(UndoOp) + undoMarks.capacity() * sizeof(size_t)
+             << " bytes for " << undoLog.size() << " edits\n";
+        cout << "  Intern table: " << wordTable.bytesUsed() << " bytes for "
+             << wordTable.size() << " distinct words\n";
+        cout << "  Word flags:   " << dictionary.capacity() + ignoredWords.capacity() +
+                                      commonMisspellings.capacity() * sizeof(WordId) << " bytes\n";
+    }
+
+
     void run() {
         string command;
         while (true) {
@@ -225,6 +506,8 @@ public:
                 ignoreWord();  // Add word to ignored list
             } else if (command == "adddict") {
                 addToPersonalDictionary();  // Add word to dictionary
+            } else if (command == "memstats") {
+                displayMemoryStats();
             } else if (command == "exit") {
                 cout << "Exiting the text editor. Goodbye!\n";
                 break;
@@ -237,20 +520,52 @@ public:
 
 private:
        LineNode* buffer;
-    unordered_set<string> dictionary;
-    unordered_set<string> ignoredWords;  // Set to store ignored words
-    unordered_map<string, string> commonMisspellings;
+    LineNode* tail;                // Last line, so appends do not walk the list
+    TextArena lineArena;           // Backing store for all line text
+    NodePool<LineNode> nodePool;   // Slab storage for the buffer's lines
+    vector<char> dictionary;               // Indexed by WordId, nonzero if known
+    vector<char> ignoredWords;             // Indexed by WordId, nonzero if ignored
+    vector<WordId> commonMisspellings;     // Indexed by WordId, NoWord if no fix
     WordGraph wordGraph;
-    stack<LineNode*> undoStack;
 
 
-    bool containsWord(const string& line, const string& word) const {
-        size_t pos = line.find(word);
-        while (pos != string::npos) {
-            bool isWholeWord = (pos == 0 || !isalnum(line[pos - 1])) &&
-                               (pos + word.length() == line.length() || !isalnum(line[pos + word.length()]));
+    // One recorded edit: an appended line (node is the line before it, or
+    // nullptr) or a line whose text was replaced (node is that line)
+    struct UndoOp {
+        LineNode* node;
+        const char* oldText;
+        size_t oldLength;
+        bool appended;
+    };
+
+
+    vector<UndoOp> undoLog;      // Every edit since the oldest saved state, in order
+    vector<size_t> undoMarks;    // Where each saved state's edits start in undoLog
+    size_t pendingStart;         // Edits from here on came after the newest saved state
+
+
+    static void markWord(vector<char>& flags, WordId id) {
+        if (static_cast<size_t>(id) >= flags.size()) {
+            flags.resize(id + 1, 0);
+        }
+        flags[id] = 1;
+    }
+
+
+    static bool hasWord(const vector<char>& flags, WordId id) {
+        return id != NoWord && static_cast<size_t>(id) < flags.size() && flags[id];
+    }
+
+
+    bool containsWord(const char* line, size_t length, const string& word) const {
+        if (word.empty()) return false;
+        const char* end = line + length;
+        const char* pos = std::search(line, end, word.begin(), word.end());
+        while (pos != end) {
+            bool isWholeWord = (pos == line || !isalnum(pos[-1])) &&
+                               (pos + word.length() == end || !isalnum(pos[word.length()]));
             if (isWholeWord) return true;
-            pos = line.find(word, pos + 1);
+            pos = std::search(pos + 1, end, word.begin(), word.end());
         }
         return false;
     }
@@ -270,46 +585,58 @@ private:
 
 
     void appendLine(const string& text) {
-        LineNode* newNode = new LineNode(text);
+        LineNode* newNode = nodePool.create(lineArena.store(text), text.size());
+        UndoOp op = { tail, nullptr, 0, true };
+        undoLog.push_back(op);
         if (!buffer) {
             buffer = newNode;
         } else {
-            LineNode* current = buffer;
-            while (current->next) {
-                current = current->next;
-            }
-            current->next = newNode;
+            tail->next = newNode;
         }
+        tail = newNode;
     }
 
 
+    // Return every line to the pool; the arena text is left alone
     void clearBuffer() {
         while (buffer) {
             LineNode* temp = buffer;
             buffer = buffer->next;
-            delete temp;
+            nodePool.destroy(temp);
+        }
+        tail = nullptr;
+    }
+
+
+    // Undo recorded edits, newest first, until only `start` of them remain
+    void revertTo(size_t start) {
+        while (undoLog.size() > start) {
+            const UndoOp& op = undoLog.back();
+            if (op.appended) {
+                LineNode* removed = tail;
+                tail = op.node;
+                if (tail) {
+                    tail->next = nullptr;
+                } else {
+                    buffer = nullptr;
+                }
+                nodePool.destroy(removed);
+            } else {
+                op.node->text = op.oldText;
+                op.node->length = op.oldLength;
+            }
+            undoLog.pop_back();
         }
     }
 
 
+    // Mark the current text as a state undo can return to; only the edits
+    // that led here are kept, not a copy of the whole buffer
     void saveState() {
-        undoStack.push(cloneBuffer());
+        undoMarks.push_back(pendingStart);
+        pendingStart = undoLog.size();
         cout<<"Word inserted successfully!!"<<endl;
     }
-
-
-    LineNode* cloneBuffer() const {
-        if (!buffer) return nullptr;
-        LineNode* head = new LineNode(buffer->text);
-        LineNode* current = head;
-        LineNode* original = buffer->next;
-        while (original) {
-            current->next = new LineNode(original->text);
-            current = current->next;
-            original = original->next;
-        }
-        return head;
-    }
 void displayMenu() const {
         cout << "\nCommands:\n";
         cout << "  insert       - Insert text\n";
@@ -321,13 +648,14 @@ void displayMenu() const {
         cout << "  replace      - Replace a word\n";
         cout << "  ignore       - Ignore a word for spellcheck\n";
         cout << "  adddict      - Add word to personal dictionary\n";
+        cout << "  memstats     - Show memory used by the editor\n";
         cout << "  exit         - Exit the editor\n";
     }
 
 
     void loadDefaultDictionary() {
     // Core dictionary words (expanded categories)
-    dictionary = {
+    static const char* const defaultWords[] = {
         "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
         "apple", "banana", "cherry", "date", "elderberry", "fig", "grape",
         "house", "island", "jungle", "kite", "lemon", "mountain", "notebook",
@@ -380,11 +708,14 @@ void displayMenu() const {
         "operation", "maintenance", "support", "service", "delivery",
         "customer", "client", "user", "stakeholder", "community", "society"
     };
+    for (const char* word : defaultWords) {
+        markWord(dictionary, wordTable.intern(word));
+    }
 
 
     // Add placeholders to reach a total of at least 500 words
     for (int i = 1; i <= 500; ++i) {
-        dictionary.insert("example" + std::to_string(i));
+        markWord(dictionary, wordTable.intern("example" + std::to_string(i)));
     }
 }
 
@@ -392,7 +723,7 @@ void displayMenu() const {
 // Function to load common misspellings
 void loadCommonMisspellings() {
     // Load a mapping of common misspellings to their correct forms
-    commonMisspellings = {
+    static const pair<const char*, const char*> defaultMisspellings[] = {
         {"teh", "the"}, {"quik", "quick"}, {"brwn", "brown"}, {"fok", "fox"},
         {"jmps", "jumps"}, {"ovr", "over"}, {"lzy", "lazy"}, {"dg", "dog"},
         {"aplpe", "apple"}, {"bananna", "banana"}, {"cheery", "cherry"},
@@ -487,6 +818,13 @@ void loadCommonMisspellings() {
         {"clent", "client"}, {"userr", "user"}, {"stakehlder", "stakeholder"},
         {"commnity", "community"}, {"socety", "society"}
     };
+    for (const auto& entry : defaultMisspellings) {
+        WordId wrong = wordTable.intern(entry.first);
+        if (static_cast<size_t>(wrong) >= commonMisspellings.size()) {
+            commonMisspellings.resize(wrong + 1, NoWord);
+        }
+        commonMisspellings[wrong] = wordTable.intern(entry.second);
+    }
 }
  std::string cleanInput(const std::string& word) const {
         std::string cleanWord;
@@ -517,7 +855,7 @@ void loadCommonMisspellings() {
     }
      void checkSpelling(const std::string& word) {
         if (word.empty()) return;
-        if (dictionary.find(word) == dictionary.end()) {
+        if (!hasWord(dictionary, wordTable.find(word))) {
             std::cout << "Misspelled word: " << word << "\n";
             suggestCorrections(word);  // Suggest corrections for the misspelled word
         }
@@ -526,13 +864,17 @@ void loadCommonMisspellings() {
 
     // Suggest corrections for a misspelled word
     void suggestCorrections(const std::string& word) const {
-        if (commonMisspellings.find(word) != commonMisspellings.end()) {
-            std::cout << "Did you mean: " << commonMisspellings.at(word) << "?\n";
+        WordId id = wordTable.find(word);
+        if (id != NoWord && static_cast<size_t>(id) < commonMisspellings.size() &&
+            commonMisspellings[id] != NoWord) {
+            std::cout << "Did you mean: " << wordTable.text(commonMisspellings[id]) << "?\n";
             return;
         }
         std::cout << "Suggestions: ";
-        for (const auto& dictWord : dictionary) {
-            if (dictWord.find(word) != std::string::npos) {  // Simple substring matching
+        for (size_t dictId = 0; dictId < dictionary.size(); ++dictId) {
+            if (!dictionary[dictId]) continue;
+            const char* dictWord = wordTable.text(static_cast<WordId>(dictId));
+            if (std::strstr(dictWord, word.c_str()) != nullptr) {  // Simple substring matching
                 std::cout << dictWord << " ";
             }
         }
@@ -548,7 +890,8 @@ void loadCommonMisspellings() {
 
     while (current) { // Traverse the linked list
         std::string word;
-        for (char c : current->text) { // Process the current line's text
+        for (size_t i = 0; i < current->length; ++i) { // Process the current line's text
+            char c = current->text[i];
             if (std::isalpha(c)) {
                 word += std::tolower(c);
             } else if (!word.empty()) {